@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+# Compares the linkage methods built with and without the compile-time
+# flag `BENCH_FLAG` for large matrices, e.g., `hclust_prefetch`
+# (default), which enables prefetching the column accesses into the
+# condensed distance matrix, or `hclust_quaternary_heap`, which uses a
+# 4-ary heap instead of a binary one in the priority queue.
+
+BENCH_DIR=$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )
+FLAG=${BENCH_FLAG:-"hclust_prefetch"}
+SIZES=${BENCH_SIZES:-"10000 20000 50000"}
+METHODS=${BENCH_METHODS:-"generic chain"}
+
+abort() {
+    >&2 echo "error: $1"
+    exit 1
+}
+
+crystal build --release -o $BENCH_DIR/hclust_bench $BENCH_DIR/hclust_bench.cr \
+    || abort "Compilation of hclust benchmark failed"
+crystal build --release -D$FLAG -o $BENCH_DIR/hclust_bench_flag $BENCH_DIR/hclust_bench.cr \
+    || abort "Compilation of hclust benchmark failed"
+
+echo "| method  | size  | default (ms) | -D$FLAG (ms) | speedup |"
+echo "| ------- | ----- | ------------ | ------------ | ------- |"
+for method in $METHODS; do
+    for size in $SIZES; do
+        export BENCH_SIZE=$size BENCH_METHOD=$method BENCH_REPEATS=${BENCH_REPEATS:-1}
+        timing=$($BENCH_DIR/hclust_bench) || abort "Benchmark failed"
+        flagged=$($BENCH_DIR/hclust_bench_flag) || abort "Benchmark failed"
+        printf "| %-7s | %5d | %12.1f | %12.1f | %7.2f |\n" \
+            "$method" "$size" "$timing" "$flagged" \
+            "$(echo "$flagged / $timing" | bc -l)"
+    done
+done
+
+rm $BENCH_DIR/hclust_bench $BENCH_DIR/hclust_bench_flag